@@ -54,6 +54,13 @@ MACRO(BUNDLE_PCRE2)
     ENDIF()
   ENDFOREACH()
 
+  # JIT is used for constant REGEXP patterns, sljit supports these targets
+  IF(CMAKE_SYSTEM_PROCESSOR MATCHES "^(x86_64|AMD64|amd64|i[3-6]86|x86|aarch64|arm64|ARM64|ppc64|ppc64le|s390x|riscv64)$")
+    SET(pcre2_jit "-DPCRE2_SUPPORT_JIT=ON")
+  ELSE()
+    SET(pcre2_jit "-DPCRE2_SUPPORT_JIT=OFF")
+  ENDIF()
+
   ExternalProject_Add(
     pcre2
     PREFIX   "${dir}"
@@ -65,6 +72,7 @@ MACRO(BUNDLE_PCRE2)
       "-DPCRE2_BUILD_TESTS=OFF"
       "-DPCRE2_BUILD_PCRE2GREP=OFF"
       "-DBUILD_SHARED_LIBS=OFF"
+      ${pcre2_jit}
       "-DCMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE}"
       "-DCMAKE_C_FLAGS=${pcre2_flags} ${PIC_FLAG}"
       "-DCMAKE_C_FLAGS_DEBUG=${pcre2_flags_DEBUG}"
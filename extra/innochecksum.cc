@@ -365,6 +365,10 @@ open_file(
 		perror("fcntl");
 		return (NULL);
 	}
+
+# ifdef POSIX_FADV_SEQUENTIAL
+	posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+# endif
 #endif /* _WIN32 */
 
 	if (do_write) {
@@ -373,6 +377,14 @@ open_file(
 		fil_in = fdopen(fd, "rb");
 	}
 
+	/* Pages are mostly read sequentially; use a larger stdio buffer
+	than the default to reduce the number of read system calls.
+	Not with --write: write_file() repositions and flushes the stream
+	for every rewritten page, which would discard the whole buffer. */
+	if (fil_in && !do_write) {
+		setvbuf(fil_in, NULL, _IOFBF, 1U << 20);
+	}
+
 	return (fil_in);
 }
 
@@ -1975,6 +1975,18 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
       buffpek->set_rowcount(0);                        /* Don't read more */
     }
     max_rows-= buffpek->mem_count();
+    if (!flag && !packed_format)
+    {
+      /*
+        Intermediate pass with fixed size records: the remaining keys of
+        the last chunk are contiguous and are copied as they are, so write
+        them with one call instead of one call per record.
+      */
+      if (my_b_write(to_file, buffpek->current_key(),
+                     (size_t) buffpek->mem_count() * rec_length))
+        goto err;
+      continue;
+    }
     for (uint ix= 0; ix <  buffpek->mem_count(); ++ix)
     {
       uchar *src= buffpek->current_key();
@@ -6133,6 +6133,8 @@ int Regexp_processor_pcre::default_regex_flags()
 
 void Regexp_processor_pcre::cleanup()
 {
+  pcre2_match_context_free(m_pcre_match_context);
+  pcre2_jit_stack_free(m_pcre_jit_stack);
   pcre2_match_data_free(m_pcre_match_data);
   pcre2_code_free(m_pcre);
   reset();
@@ -6281,9 +6283,12 @@ int Regexp_processor_pcre::pcre_exec_with_warn(const pcre2_code *code,
   mctx= pcre2_match_context_create(NULL);
   pcre2_set_recursion_limit(mctx,
     available_stack_size(&mctx, current_thd->mysys_var->stack_ends_here)/544);
+  if (m_pcre_jit_stack)
+    pcre2_jit_stack_assign(mctx, NULL, m_pcre_jit_stack);
 #endif
   int rc= pcre2_match(code, (PCRE2_SPTR8) subject, (PCRE2_SIZE) length,
-                      (PCRE2_SIZE) startoffset, options, data, mctx);
+                      (PCRE2_SIZE) startoffset, options, data,
+                      mctx ? mctx : m_pcre_match_context);
   pcre2_match_context_free(mctx); // NULL is ok here
   DBUG_EXECUTE_IF("pcre_exec_error_123", rc= -123;);
   if (unlikely(rc < PCRE2_ERROR_NOMATCH))
@@ -6378,6 +6383,22 @@ bool Regexp_processor_pcre::fix_owner(Item_func *owner,
       return true;
     }
     set_const(true);
+    /*
+      The pattern will be matched against many subjects: let PCRE2 translate
+      it to machine code. This fails harmlessly if the library was built
+      without JIT support, pcre2_match() then uses the interpreter.
+
+      The default JIT stack of 32KiB is too small for backtracking over
+      long subjects. Give the JIT code a bigger stack; its memory is
+      only committed when it is used. compile() keeps the compiled
+      pattern and the stack if the pattern has not changed.
+    */
+    if (!m_pcre_jit_stack &&
+        !pcre2_jit_compile(m_pcre, PCRE2_JIT_COMPLETE) &&
+        (m_pcre_jit_stack= pcre2_jit_stack_create(32 * 1024,
+                                                  8 * 1024 * 1024, NULL)) &&
+        (m_pcre_match_context= pcre2_match_context_create(NULL)))
+      pcre2_jit_stack_assign(m_pcre_match_context, NULL, m_pcre_jit_stack);
     owner->base_flags|= subject_arg->base_flags & item_base_t::MAYBE_NULL;
   }
   else
@@ -3034,11 +3034,16 @@ class Item_func_like :public Item_bool_func2
 
 typedef struct pcre2_real_code_8 pcre2_code;
 typedef struct pcre2_real_match_data_8 pcre2_match_data;
+typedef struct pcre2_real_match_context_8 pcre2_match_context;
+typedef struct pcre2_real_jit_stack_8 pcre2_jit_stack;
 #define PCRE2_SIZE size_t
 class Regexp_processor_pcre
 {
   pcre2_code *m_pcre;
   pcre2_match_data *m_pcre_match_data;
+  /* JIT stack for constant patterns, and the match context using it */
+  pcre2_jit_stack *m_pcre_jit_stack;
+  pcre2_match_context *m_pcre_match_context;
   bool m_conversion_is_needed;
   bool m_is_const;
   int m_library_flags;
@@ -3058,6 +3063,7 @@ class Regexp_processor_pcre
   String replace_converter;
   Regexp_processor_pcre() :
     m_pcre(NULL), m_pcre_match_data(NULL),
+    m_pcre_jit_stack(NULL), m_pcre_match_context(NULL),
     m_conversion_is_needed(true), m_is_const(0),
     m_library_flags(0),
     m_library_charset(&my_charset_utf8mb4_general_ci)
@@ -3092,6 +3098,8 @@ class Regexp_processor_pcre
   {
     m_pcre= NULL;
     m_pcre_match_data= NULL;
+    m_pcre_jit_stack= NULL;
+    m_pcre_match_context= NULL;
     m_prev_pattern.length(0);
   }
   void cleanup();
@@ -134,6 +134,8 @@ static ulonglong binlog_status_var_num_group_commits;
 static ulonglong binlog_status_group_commit_trigger_count;
 static ulonglong binlog_status_group_commit_trigger_lock_wait;
 static ulonglong binlog_status_group_commit_trigger_timeout;
+static ulonglong binlog_status_group_commit_write_usec;
+static ulonglong binlog_status_group_commit_sync_usec;
 static char binlog_snapshot_file[FN_REFLEN];
 static ulonglong binlog_snapshot_position;
 
@@ -156,6 +158,10 @@ static SHOW_VAR binlog_status_vars_detail[]=
     (char *)&binlog_status_group_commit_trigger_lock_wait, SHOW_LONGLONG},
   {"group_commit_trigger_timeout",
     (char *)&binlog_status_group_commit_trigger_timeout, SHOW_LONGLONG},
+  {"group_commit_write_usec",
+    (char *)&binlog_status_group_commit_write_usec, SHOW_LONGLONG},
+  {"group_commit_sync_usec",
+    (char *)&binlog_status_group_commit_sync_usec, SHOW_LONGLONG},
   {"snapshot_file",
     (char *)&binlog_snapshot_file, SHOW_CHAR},
   {"snapshot_position",
@@ -3617,7 +3623,9 @@ MYSQL_BIN_LOG::MYSQL_BIN_LOG(uint *sync_period)
    group_commit_queue(0), group_commit_queue_busy(FALSE),
    num_commits(0), num_group_commits(0),
    group_commit_trigger_count(0), group_commit_trigger_timeout(0),
-   group_commit_trigger_lock_wait(0), gtid_index(nullptr),
+   group_commit_trigger_lock_wait(0),
+   group_commit_write_time(0), group_commit_sync_time(0),
+   gtid_index(nullptr),
    sync_period_ptr(sync_period), sync_counter(0),
    state_file_deleted(false), binlog_state_recover_done(false),
    is_relay_log(0), relay_signal_cnt(0),
@@ -9078,6 +9086,7 @@ void MYSQL_BIN_LOG::trx_group_commit_with_engines(group_commit_entry *leader,
   ulong UNINIT_VAR(binlog_id);
   my_off_t UNINIT_VAR(commit_offset);
   group_commit_entry *current;
+  ulonglong write_time= 0, sync_time= 0;
 
   DBUG_ENTER("MYSQL_BIN_LOG::trx_group_commit_with_engines");
   mysql_mutex_assert_owner(&LOCK_log);
@@ -9097,6 +9106,7 @@ void MYSQL_BIN_LOG::trx_group_commit_with_engines(group_commit_entry *leader,
                                            commit_name.length);
         commit_id= entry->val_int(&null_value);
       });
+    ulonglong start_time= microsecond_interval_timer();
     /*
       Commit every transaction in the queue.
 
@@ -9152,8 +9162,12 @@ void MYSQL_BIN_LOG::trx_group_commit_with_engines(group_commit_entry *leader,
     }
     set_current_thd(leader->thd);
 
+    ulonglong sync_start_time= microsecond_interval_timer();
+    write_time= sync_start_time - start_time;
     bool synced= 0;
-    if (unlikely(flush_and_sync(&synced)))
+    bool sync_error= flush_and_sync(&synced);
+    sync_time= microsecond_interval_timer() - sync_start_time;
+    if (unlikely(sync_error))
     {
       for (current= leader; current != NULL; current= current->next)
       {
@@ -9305,6 +9319,8 @@ void MYSQL_BIN_LOG::trx_group_commit_with_engines(group_commit_entry *leader,
   mysql_mutex_unlock(&LOCK_after_binlog_sync);
   DEBUG_SYNC(leader->thd, "commit_after_release_LOCK_after_binlog_sync");
   ++num_group_commits;
+  group_commit_write_time+= write_time;
+  group_commit_sync_time+= sync_time;
 
   if (!opt_optimize_thread_scheduling)
   {
@@ -12908,6 +12924,8 @@ TC_LOG_BINLOG::set_status_variables(THD *thd)
   mysql_mutex_lock(&LOCK_commit_ordered);
   binlog_status_var_num_commits= this->num_commits;
   binlog_status_var_num_group_commits= this->num_group_commits;
+  binlog_status_group_commit_write_usec= this->group_commit_write_time;
+  binlog_status_group_commit_sync_usec= this->group_commit_sync_time;
   if (!have_snapshot)
   {
     set_binlog_snapshot_file(last_commit_pos_file);
@@ -728,6 +728,12 @@ class MYSQL_BIN_LOG: public TC_LOG, private Event_log
   /* The reason why the group commit was grouped */
   ulonglong group_commit_trigger_count, group_commit_trigger_timeout;
   ulonglong group_commit_trigger_lock_wait;
+  /*
+    Time in microseconds that group commit leaders spent writing
+    transactions to the binlog, and flushing and syncing the binlog.
+    Used with the LOCK_commit_ordered mutex.
+  */
+  ulonglong group_commit_write_time, group_commit_sync_time;
 
   /* Binlog GTID index. */
   Gtid_index_writer *gtid_index;
@@ -449,7 +449,12 @@ struct MDL_key
   }
   bool is_equal(const MDL_key *rhs) const
   {
-    return (m_length == rhs->m_length &&
+    /*
+      Compare the precomputed hash values first: MDL_context::find_ticket()
+      calls this for every ticket of the context, and most of them differ.
+    */
+    return (m_hash_value == rhs->m_hash_value &&
+            m_length == rhs->m_length &&
             memcmp(m_ptr, rhs->m_ptr, m_length) == 0);
   }
   /**
@@ -164,6 +164,7 @@ class READ_INFO: public Load_data_param
   int	*stack,*stack_pos;
   bool	found_end_of_line,start_of_line,eof;
   int level; /* for load xml */
+  bool ascii_based; /* Bytes below 0x80 are always single byte characters */
 
   bool getbyte(char *to)
   {
@@ -208,6 +209,8 @@ class READ_INFO: public Load_data_param
   bool read_mbtail(String *str)
   {
     int chlen;
+    if (ascii_based && (uchar) str->end()[-1] < 0x80)
+      return false; // ASCII character, avoid the charlen() call
     if ((chlen= charset()->charlen(str->end() - 1, str->end())) == 1)
       return false; // Single byte character found
     for (uint32 length0= str->length() - 1 ; MY_CS_IS_TOOSMALL(chlen); )
@@ -1431,6 +1434,7 @@ READ_INFO::READ_INFO(THD *thd, File file_par,
   */
 
   level= 0; /* for load xml */
+  ascii_based= my_charset_is_ascii_based(charset());
   start_of_line= line_start.length() != 0;
   /* If field_terminator == line_terminator, don't use line_terminator */
   if (m_field_term.eq(m_line_term))
@@ -133,8 +133,11 @@ struct Table_cache_instance
   ulong records;
   uint mutex_waits;
   uint mutex_nowaits;
+  /** Number of TABLE object acquisitions that had to wait for the mutex */
+  Atomic_counter<ulonglong> total_mutex_waits;
 
-  Table_cache_instance(): records(0), mutex_waits(0), mutex_nowaits(0)
+  Table_cache_instance(): records(0), mutex_waits(0), mutex_nowaits(0),
+                          total_mutex_waits(0)
   {
     static_assert(!(sizeof(*this) % CPU_LEVEL1_DCACHE_LINESIZE), "alignment");
     mysql_mutex_init(key_LOCK_table_cache, &LOCK_table_cache,
@@ -177,6 +180,7 @@ struct Table_cache_instance
     if (mysql_mutex_trylock(&LOCK_table_cache))
     {
       mysql_mutex_lock(&LOCK_table_cache);
+      total_mutex_waits++;
       if (++mutex_waits == 20000)
       {
         if (n_instances < tc_instances)
@@ -1230,6 +1234,19 @@ int show_tc_active_instances(THD *thd, SHOW_VAR *var, void *buff,
 }
 
 
+int show_tc_instance_waits(THD *thd, SHOW_VAR *var, void *buff,
+                           system_status_var *, enum enum_var_type scope)
+{
+  ulonglong total= 0;
+  var->type= SHOW_LONGLONG;
+  var->value= buff;
+  for (uint32 i= 0; i < tc_instances; i++)
+    total+= tc[i].total_mutex_waits;
+  *(reinterpret_cast<ulonglong*>(buff))= total;
+  return 0;
+}
+
+
 /**
   Waits until ref_count goes down to given number
 
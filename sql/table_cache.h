@@ -89,6 +89,8 @@ extern int tdc_iterate(THD *thd, my_hash_walk_action action, void *argument,
 extern uint tc_records(void);
 int show_tc_active_instances(THD *thd, SHOW_VAR *var, void *buff,
                              system_status_var *, enum enum_var_type scope);
+int show_tc_instance_waits(THD *thd, SHOW_VAR *var, void *buff,
+                           system_status_var *, enum enum_var_type scope);
 extern void tc_purge();
 extern void tc_add_table(THD *thd, TABLE *table);
 extern void tc_release_table(TABLE *table);
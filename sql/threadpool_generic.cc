@@ -121,6 +121,8 @@ static int  wake_or_create_thread(thread_group_t *thread_group, bool due_to_stal
 static int  create_worker(thread_group_t *thread_group, bool due_to_stall);
 static void *worker_main(void *param);
 static void check_stall(thread_group_t *thread_group);
+static int  change_group(TP_connection_generic *c, thread_group_t *old_group,
+                         thread_group_t *new_group);
 static void set_next_timeout_check(ulonglong abstime);
 static void print_pool_blocked_message(bool);
 
@@ -480,6 +482,89 @@ static bool is_queue_empty(thread_group_t *thread_group)
 }
 
 
+/**
+  Take a queued event from another, busy thread group.
+
+  A group keeps only one thread active, so events queued behind a long
+  running query wait even if workers in other groups are idle. Take such
+  an event and handle it in the current group. The connection returns to
+  its own group in start_io(), like after a thread_pool_size change.
+
+  The caller holds thread_group->mutex, it is released while the
+  connection changes groups. Other groups' mutexes are only try-locked,
+  so there is no lock order to respect.
+
+  @return connection with pending event, or NULL if there is nothing
+  to steal.
+*/
+
+static TP_connection_generic *queue_steal(thread_group_t *thread_group)
+{
+  const size_t n_groups= group_count;
+  const size_t own= size_t(thread_group - all_groups);
+
+  for (size_t i= 1; i < n_groups; i++)
+  {
+    thread_group_t *busy_group= &all_groups[(own + i) % n_groups];
+    if (mysql_mutex_trylock(&busy_group->mutex))
+      continue;
+    TP_connection_generic *c= NULL;
+    /*
+      Leave the queue to the group itself if it is about to handle it.
+      Do not call queue_get() on an empty queue, it would count as
+      progress for check_stall() and hide a real stall.
+    */
+    if (!busy_group->shutdown && busy_group->active_thread_count > 0 &&
+        !is_queue_empty(busy_group))
+      c= queue_get(busy_group, operation_origin::WORKER);
+    mysql_mutex_unlock(&busy_group->mutex);
+    if (c)
+    {
+      mysql_mutex_unlock(&thread_group->mutex);
+      /* Cannot fail, the current group has a thread. */
+      change_group(c, busy_group, thread_group);
+      c->fix_group= true;
+      mysql_mutex_lock(&thread_group->mutex);
+      return c;
+    }
+  }
+  return NULL;
+}
+
+
+/**
+  Wake an idle worker in another group, to take over events queued in the
+  stalled thread_group (see queue_steal()) rather than adding a thread to it.
+
+  The caller holds thread_group->mutex. Other groups' mutexes are only
+  try-locked.
+
+  @return true if a worker was woken
+*/
+
+static bool wake_idle_group(thread_group_t *thread_group)
+{
+  const size_t n_groups= group_count;
+  const size_t own= size_t(thread_group - all_groups);
+
+  if (!thread_group->active_thread_count)
+    return false;
+
+  for (size_t i= 1; i < n_groups; i++)
+  {
+    thread_group_t *idle_group= &all_groups[(own + i) % n_groups];
+    if (mysql_mutex_trylock(&idle_group->mutex))
+      continue;
+    bool woken= !idle_group->shutdown && !idle_group->active_thread_count &&
+      is_queue_empty(idle_group) && !wake_thread(idle_group, false);
+    mysql_mutex_unlock(&idle_group->mutex);
+    if (woken)
+      return true;
+  }
+  return false;
+}
+
+
 static void queue_init(thread_group_t *thread_group)
 {
   for (int i=0; i < NQUEUES; i++)
@@ -676,7 +761,9 @@ void check_stall(thread_group_t *thread_group)
   {
     thread_group->stalled= true;
     TP_INCREMENT_GROUP_COUNTER(thread_group,stalls);
-    wake_or_create_thread(thread_group,true);
+    /* Prefer an idle worker of another group to a new thread here. */
+    if (!wake_idle_group(thread_group))
+      wake_or_create_thread(thread_group,true);
   }
 
   /* Reset queue event count */
@@ -1220,6 +1307,10 @@ TP_connection_generic *get_event(worker_thread_t *current_thread,
       }
     }
 
+    /* Help other groups before going to sleep. */
+    if (!oversubscribed && (connection= queue_steal(thread_group)))
+      break;
+
 
     /* And now, finally sleep */
     current_thread->woken = false; /* wake() sets this to true */
@@ -486,6 +486,16 @@ my_off_t find_eoln_buff(Transparent_file *data_buff, my_off_t begin,
 
   for (my_off_t x= begin; x < end; x++)
   {
+    const uchar *data;
+    /* Skip the part of the line that is already in the read window */
+    if (size_t length= data_buff->get_window(x, end, &data))
+    {
+      size_t i= 0;
+      while (i < length && data[i] != '\n' && data[i] != '\r')
+        i++;
+      if ((x+= i) == end)
+        break;
+    }
     /* Unix (includes Mac OS X) */
     if (data_buff->get_value(x) == '\n')
       *eoln_len= 1;
@@ -669,6 +679,32 @@ int ha_tina::chain_append()
 }
 
 
+/*
+  Copy a run of ordinary symbols of a field to the buffer.
+
+  Appends the symbols from curr_offset onwards that are present in the read
+  window and are neither 'delim' nor a backslash, so that the callers only
+  need to interpret the special symbols one by one. The last symbol of the
+  line is never consumed, because it needs extra checks.
+
+  Returns the number of symbols appended.
+*/
+
+static size_t append_plain_symbols(Transparent_file *data_buff,
+                                   String *buffer, my_off_t curr_offset,
+                                   my_off_t end_offset, char delim)
+{
+  const uchar *data;
+  size_t length= data_buff->get_window(curr_offset, end_offset - 1, &data);
+  size_t i= 0;
+  while (i < length && data[i] != (uchar) delim && data[i] != '\\')
+    i++;
+  if (i)
+    buffer->append((const char*) data, i);
+  return i;
+}
+
+
 /*
   Scans for a row.
 */
@@ -746,6 +782,8 @@ int ha_tina::find_current_row(uchar *buf)
       /* Loop through the row to extract the values for the current field */
       for ( ; curr_offset < end_offset; curr_offset++)
       {
+        curr_offset+= append_plain_symbols(file_buff, &buffer, curr_offset,
+                                           end_offset, '"');
         curr_char= file_buff->get_value(curr_offset);
         /* check for end of the current field */
         if (curr_char == '"' &&
@@ -798,6 +836,8 @@ int ha_tina::find_current_row(uchar *buf)
     {
       for ( ; curr_offset < end_offset; curr_offset++)
       {
+        curr_offset+= append_plain_symbols(file_buff, &buffer, curr_offset,
+                                           end_offset, ',');
         curr_char= file_buff->get_value(curr_offset);
         /* Move past the ,*/
         if (curr_char == ',')
@@ -107,3 +107,19 @@ char Transparent_file::get_value(my_off_t offset)
 
   return buff[0];
 }
+
+
+/*
+  Give direct access to the bytes in [offset, end) that are present in
+  the current window. Returns their number (0 if the byte at offset has
+  not been read) and sets *data to point to the first of them.
+*/
+
+size_t Transparent_file::get_window(my_off_t offset, my_off_t end,
+                                    const uchar **data)
+{
+  if (offset < lower_bound || offset >= upper_bound || offset >= end)
+    return 0;
+  *data= buff + (offset - lower_bound);
+  return (size_t) (MY_MIN(end, upper_bound) - offset);
+}
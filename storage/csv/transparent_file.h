@@ -39,5 +39,6 @@ class Transparent_file
   my_off_t start();
   my_off_t end();
   char get_value (my_off_t offset);
+  size_t get_window(my_off_t offset, my_off_t end, const uchar **data);
   my_off_t read_next();
 };
@@ -532,8 +532,10 @@ btr_pcur_move_to_next_page(
 
 	const auto s = mtr->get_savepoint();
 	mtr->rollback_to_savepoint(s - 2, s - 1);
-	if (first_access) {
-		buf_read_ahead_linear(next_block->page.id());
+	if (first_access
+	    && !buf_read_ahead_linear(next_block->page.id())) {
+		buf_read_ahead_next(next_block->page.id(),
+				    btr_page_get_next(next_page));
 	}
 	return DB_SUCCESS;
 }
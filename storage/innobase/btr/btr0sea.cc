@@ -1164,12 +1164,16 @@ btr_search_guess_on_hash(
 		goto fail;
 	}
 
+	/* The search info is shared by all threads that search the
+	index. Avoid dirtying its cache line when nothing changes. */
 	if (info->n_hash_potential < BTR_SEARCH_BUILD_LIMIT + 5) {
 
 		info->n_hash_potential++;
 	}
 
-	info->last_hash_succ = TRUE;
+	if (UNIV_UNLIKELY(!info->last_hash_succ)) {
+		info->last_hash_succ = TRUE;
+	}
 
 #ifdef UNIV_SEARCH_PERF_STAT
 	btr_search_n_succ++;
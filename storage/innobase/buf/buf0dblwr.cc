@@ -680,7 +680,21 @@ void buf_dblwr_t::flush_buffered_writes_completed(const IORequest &request)
   os_file_flush(request.node->handle);
 
   /* The writes have been flushed to disk now and in recovery we will
-  find them in the doublewrite buffer blocks. Next, write the data pages. */
+  find them in the doublewrite buffer blocks. Next, write the data pages.
+  Before that, ensure that the redo log has been durably written for all
+  of them, so that the page writes can be submitted as one batch. */
+  lsn_t max_lsn= 0;
+  for (ulint i= 0, first_free= flush_slot->first_free; i < first_free; i++)
+  {
+    const void *frame= get_frame(flush_slot->buf_block_arr[i].request);
+    max_lsn= std::max(max_lsn,
+                      mach_read_from_8(my_assume_aligned<8>
+                                       (FIL_PAGE_LSN +
+                                        static_cast<const byte*>(frame))));
+  }
+  log_write_up_to(max_lsn, true);
+
+  os_aio_batch_begin();
   for (ulint i= 0, first_free= flush_slot->first_free; i < first_free; i++)
   {
     auto e= flush_slot->buf_block_arr[i];
@@ -703,15 +717,16 @@ void buf_dblwr_t::flush_buffered_writes_completed(const IORequest &request)
       ut_d(buf_dblwr_check_page_lsn(*bpage, static_cast<const byte*>(frame)));
     }
 
-    const lsn_t lsn= mach_read_from_8(my_assume_aligned<8>
-                                      (FIL_PAGE_LSN +
-                                       static_cast<const byte*>(frame)));
+    ut_d(const lsn_t lsn= mach_read_from_8(my_assume_aligned<8>
+                                           (FIL_PAGE_LSN +
+                                            static_cast<const byte*>(frame))));
     ut_ad(lsn);
     ut_ad(lsn >= bpage->oldest_modification());
-    log_write_up_to(lsn, true);
+    ut_ad(lsn <= max_lsn);
     e.request.node->space->io(e.request, bpage->physical_offset(), e_size,
                               frame, bpage);
   }
+  os_aio_batch_end();
 }
 
 /** Flush possible buffered writes to persistent storage.
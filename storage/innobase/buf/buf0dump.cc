@@ -592,6 +592,10 @@ buf_load()
 	mysql_stage_set_work_estimated(pfs_stage_progress, dump_n);
 	mysql_stage_set_work_completed(pfs_stage_progress, 0);
 
+	/* The dump is sorted by page number, so let the requests for
+	nearby pages be submitted together. */
+	os_aio_batch_begin();
+
 	for (i = 0; i < dump_n && !SHUTTING_DOWN(); i++) {
 
 		/* space_id for this iteration of the loop */
@@ -635,6 +639,7 @@ buf_load()
 		buf_read_page_background(space, dump[i], zip_size);
 
 		if (buf_load_abort_flag) {
+			os_aio_batch_end();
 			if (space) {
 				space->release();
 			}
@@ -660,6 +665,8 @@ buf_load()
 #endif
 	}
 
+	os_aio_batch_end();
+
 	if (space) {
 		space->release();
 	}
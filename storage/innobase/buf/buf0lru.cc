@@ -747,10 +747,17 @@ void buf_page_make_young(buf_page_t *bpage)
 
   if (UNIV_UNLIKELY(bpage->old))
     buf_pool.stat.n_pages_made_young++;
+  else if (buf_page_peek_if_young(bpage))
+    /* Several threads that access a hot page may have seen it as
+    too old at the same time. Once the first of them has moved it
+    to the start of the LRU list, there is no point in moving it
+    again while holding the contended buf_pool.mutex. */
+    goto func_exit;
 
   buf_LRU_remove_block(bpage);
   buf_LRU_add_block(bpage, false);
 
+func_exit:
   mysql_mutex_unlock(&buf_pool.mutex);
 }
 
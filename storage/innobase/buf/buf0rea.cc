@@ -693,6 +693,62 @@ ulint buf_read_ahead_linear(const page_id_t page_id)
   return count;
 }
 
+/** Read ahead the right sibling of a B-tree leaf page that is being
+accessed for the first time by a range scan. After page splits, the
+leaf pages of an index are seldom adjacent in the file, so that
+buf_read_ahead_linear() would not recognize the scan.
+@param page_id	the page that is being accessed
+@param next	FIL_PAGE_NEXT of the page
+@return number of page read requests issued */
+ulint buf_read_ahead_next(const page_id_t page_id, uint32_t next)
+{
+  if (!srv_leaf_read_ahead || page_id.space() >= SRV_TMP_SPACE_ID ||
+      next == FIL_NULL || next == page_id.page_no())
+    return 0;
+
+  if (srv_startup_is_before_trx_rollback_phase)
+    /* No read-ahead to avoid thread deadlocks */
+    return 0;
+
+  if (os_aio_pending_reads_approx() >
+      buf_pool.curr_size / BUF_READ_AHEAD_PEND_LIMIT)
+    return 0;
+
+  const page_id_t next_id{page_id.space(), next};
+  buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(next_id.fold());
+  if (buf_pool.page_hash_contains(next_id, chain))
+    return 0;
+
+  fil_space_t *space= fil_space_t::get(page_id.space());
+  if (!space)
+    return 0;
+
+  buf_block_t *block= nullptr;
+  unsigned zip_size{space->zip_size()};
+  if (zip_size && recv_recovery_is_on())
+    zip_size|= 1;
+  if ((UNIV_LIKELY(!zip_size) || (zip_size & 1)) &&
+      UNIV_UNLIKELY(!(block= buf_read_acquire())))
+  {
+    space->release();
+    return 0;
+  }
+
+  if (buf_read_page_low(next_id, zip_size, chain, space, block) != DB_SUCCESS)
+  {
+    buf_read_release(block);
+    return 0;
+  }
+
+  ut_ad(!block);
+  mariadb_increment_pages_prefetched(1);
+  mysql_mutex_lock(&buf_pool.mutex);
+  buf_LRU_stat_inc_io();
+  buf_pool.stat.n_ra_pages_read++;
+  mysql_mutex_unlock(&buf_pool.mutex);
+  return 1;
+}
+
 /** Schedule a page for recovery.
 @param space    tablespace
 @param page_id  page identifier
@@ -19641,6 +19641,11 @@ static MYSQL_SYSVAR_BOOL(random_read_ahead, srv_random_read_ahead,
   "Whether to use read ahead for random access within an extent",
   NULL, NULL, FALSE);
 
+static MYSQL_SYSVAR_BOOL(leaf_read_ahead, srv_leaf_read_ahead,
+  PLUGIN_VAR_NOCMDARG,
+  "Whether range scans read ahead the next leaf page of an index",
+  NULL, NULL, TRUE);
+
 static MYSQL_SYSVAR_ULONG(read_ahead_threshold, srv_read_ahead_threshold,
   PLUGIN_VAR_RQCMDARG,
   "Number of pages that must be accessed sequentially for InnoDB to"
@@ -19968,6 +19973,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(numa_interleave),
 #endif /* HAVE_LIBNUMA */
   MYSQL_SYSVAR(random_read_ahead),
+  MYSQL_SYSVAR(leaf_read_ahead),
   MYSQL_SYSVAR(read_ahead_threshold),
   MYSQL_SYSVAR(read_only),
   MYSQL_SYSVAR(read_only_compressed),
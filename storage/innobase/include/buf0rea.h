@@ -86,6 +86,16 @@ latches!
 @return number of page read requests issued */
 ulint buf_read_ahead_linear(const page_id_t page_id);
 
+/** Read ahead the right sibling of a B-tree leaf page that is being
+accessed for the first time by a range scan. After page splits, the
+leaf pages of an index are seldom adjacent in the file, so that
+buf_read_ahead_linear() would not recognize the scan.
+This is controlled by innodb_leaf_read_ahead.
+@param page_id	the page that is being accessed
+@param next	FIL_PAGE_NEXT of the page
+@return number of page read requests issued */
+ulint buf_read_ahead_next(const page_id_t page_id, uint32_t next);
+
 /** Schedule a page for recovery.
 @param space    tablespace
 @param page_id  page identifier
@@ -188,6 +188,9 @@ struct log_t
 public:
   /** number of append_prepare_wait(); protected by lock_lsn() or lsn_lock */
   size_t waits;
+  /** total duration of append_prepare_wait(), in microseconds;
+  protected by lock_lsn() or lsn_lock */
+  ulonglong wait_time;
   /** innodb_log_buffer_size (size of buf,flush_buf if !is_mmap(), in bytes) */
   unsigned buf_size;
   /** log file size in bytes, including the header */
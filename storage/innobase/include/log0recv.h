@@ -236,6 +236,10 @@ struct recv_sys_t
   lsn_t file_checkpoint;
   /** the time when progress was last reported */
   time_t progress_time;
+  /** the time when apply() started processing the current batch */
+  time_t apply_start_time;
+  /** pages.size() when apply() started processing the current batch */
+  size_t apply_start_pages;
 
   using map = std::map<const page_id_t, page_recv_t,
                        std::less<const page_id_t>,
@@ -394,7 +398,9 @@ struct recv_sys_t
   template<typename source>
   ATTRIBUTE_COLD void rewind(source &l, source &begin) noexcept;
 
-  /** Report progress in terms of LSN or pages remaining */
+  /** Report progress in terms of LSN or pages remaining, and while
+  applying log, the apply rate and the estimated time to complete
+  the current batch */
   ATTRIBUTE_COLD void report_progress() const;
 public:
   /** Parse and register one log_t::FORMAT_10_8 mini-transaction,
@@ -1059,6 +1059,12 @@ void os_fake_read(const IORequest &type, os_offset_t offset);
 @retval DB_IO_ERROR on I/O error */
 dberr_t os_aio(const IORequest &type, void *buf, os_offset_t offset, size_t n);
 
+/** Start a batch of asynchronous requests from the current thread.
+The submission of the requests may be deferred until os_aio_batch_end(). */
+void os_aio_batch_begin();
+/** Submit the requests that were deferred since os_aio_batch_begin(). */
+void os_aio_batch_end();
+
 /** @return number of pending reads */
 size_t os_aio_pending_reads();
 /** @return approximate number of pending reads */
@@ -440,7 +440,13 @@ struct mysql_row_templ_t {
 	ulint	is_virtual;		/*!< if a column is a virtual column */
 };
 
+/* Initial number of rows that are converted in one fetch_cache batch */
 #define MYSQL_FETCH_CACHE_SIZE		8
+/* Maximum number of rows in one fetch_cache batch; the batch size is
+doubled every time a full batch has been consumed from the same cursor */
+#define MYSQL_FETCH_CACHE_MAX_SIZE	128
+/* Upper limit of the fetch_cache memory, in bytes */
+#define MYSQL_FETCH_CACHE_MAX_BYTES	(64U << 10)
 /* After fetching this many rows, we start caching them in fetch_cache */
 #define MYSQL_FETCH_CACHE_THRESHOLD	4
 
@@ -616,16 +622,18 @@ struct row_prebuilt_t {
 	ulint		n_rows_fetched;	/*!< number of rows fetched after
 					positioning the current cursor */
 	ulint		fetch_direction;/*!< ROW_SEL_NEXT or ROW_SEL_PREV */
-	byte*		fetch_cache[MYSQL_FETCH_CACHE_SIZE];
+	byte**		fetch_cache;
 					/*!< a cache for fetched rows if we
 					fetch many rows from the same cursor:
 					it saves CPU time to fetch them in a
-					batch; we reserve mysql_row_len
-					bytes for each such row; these
-					pointers point 4 bytes past the
-					allocated mem buf start, because
-					there is a 4 byte magic number at the
-					start and at the end */
+					batch; an array of fetch_cache_size
+					pointers, allocated together with
+					the row buffers that follow it; we
+					reserve mysql_row_len bytes for each
+					such row; the pointers point 4 bytes
+					past the start of each row buffer,
+					because there is a 4 byte magic
+					number at the start and at the end */
 	bool		keep_other_fields_on_keyread; /*!< when using fetch
 					cache with HA_EXTRA_KEYREAD, don't
 					overwrite other fields in mysql row
@@ -634,6 +642,12 @@ struct row_prebuilt_t {
 					fetched row in fetch_cache */
 	ulint		n_fetch_cached;	/*!< number of not yet fetched rows
 					in fetch_cache */
+	ulint		fetch_cache_size;/*!< number of allocated
+					fetch_cache slots */
+	ulint		fetch_batch_size;/*!< number of rows to cache in
+					the current batch; grows from
+					MYSQL_FETCH_CACHE_SIZE on long
+					scans of the same cursor */
 	mem_heap_t*	blob_heap;	/*!< in SELECTS BLOB fields are copied
 					to this heap */
 	mem_heap_t*	old_vers_heap;	/*!< memory heap where a previous
@@ -80,6 +80,10 @@ row_printf_step(
 /*============*/
 	que_thr_t*	thr);	/*!< in: query thread */
 
+/** Free the prefetch cache.
+@param prebuilt   prebuilt struct */
+void row_sel_prefetch_cache_free(row_prebuilt_t *prebuilt);
+
 /** Copy used fields from cached row.
 Copy cache record field by field, don't touch fields that
 are not covered by current key.
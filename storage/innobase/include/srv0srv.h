@@ -249,6 +249,7 @@ extern ulint	srv_lock_table_size;
 /** the value of innodb_checksum_algorithm */
 extern ulong	srv_checksum_algorithm;
 extern my_bool	srv_random_read_ahead;
+extern my_bool	srv_leaf_read_ahead;
 extern ulong	srv_read_ahead_threshold;
 extern uint	srv_n_read_io_threads;
 extern uint	srv_n_write_io_threads;
@@ -46,6 +46,7 @@ Created 5/7/1996 Heikki Tuuri
 #include "srv0mon.h"
 #include "que0que.h"
 #include "scope.h"
+#include "mariadb_stats.h"
 #include <debug_sync.h>
 #include <mysql/service_thd_mdl.h>
 
@@ -2060,6 +2061,8 @@ dberr_t lock_wait(que_thr_t *thr)
      wait_lock->un_member.tab_lock.table->id <= DICT_FIELDS_ID);
   thd_wait_begin(trx->mysql_thd, (type_mode & LOCK_TABLE)
                  ? THD_WAIT_TABLE_LOCK : THD_WAIT_ROW_LOCK);
+  /* Account the wait in ANALYZE r_engine_stats */
+  const ulonglong mariadb_timer= mariadb_stats_active() ? mariadb_measure() : 0;
 
   mysql_mutex_lock(&lock_sys.wait_mutex);
   /* Now that we are holding lock_sys.wait_mutex, we must reload
@@ -2203,6 +2206,8 @@ dberr_t lock_wait(que_thr_t *thr)
       }
     });
   thd_wait_end(trx->mysql_thd);
+  if (mariadb_timer)
+    mariadb_increment_lock_wait_time(mariadb_timer);
 
 #ifdef UNIV_DEBUG
   switch (trx->error_state) {
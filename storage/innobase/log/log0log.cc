@@ -1498,11 +1498,13 @@ log_print(
 		"Log sequence number " LSN_PF "\n"
 		"Log flushed up to   " LSN_PF "\n"
 		"Pages flushed up to " LSN_PF "\n"
-		"Last checkpoint at  " LSN_PF "\n",
+		"Last checkpoint at  " LSN_PF "\n"
+		"Log buffer waits %zu, total wait time %llu us\n",
 		lsn,
 		log_sys.get_flushed_lsn(),
 		pages_flushed,
-		lsn_t{log_sys.last_checkpoint_lsn});
+		lsn_t{log_sys.last_checkpoint_lsn},
+		log_sys.waits, log_sys.wait_time);
 
 	log_sys.latch.rd_unlock();
 }
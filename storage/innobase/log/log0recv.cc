@@ -3416,13 +3416,7 @@ void recv_sys_t::report_progress() const
 {
   mysql_mutex_assert_owner(&mutex);
   const size_t n{pages.size()};
-  if (recv_sys.scanned_lsn == recv_sys.lsn)
-  {
-    sql_print_information("InnoDB: To recover: %zu pages", n);
-    service_manager_extend_timeout(INNODB_EXTEND_TIMEOUT_INTERVAL,
-                                   "To recover: %zu pages", n);
-  }
-  else
+  if (recv_sys.scanned_lsn != recv_sys.lsn)
   {
     sql_print_information("InnoDB: To recover: LSN " LSN_PF
                           "/" LSN_PF "; %zu pages",
@@ -3431,7 +3425,31 @@ void recv_sys_t::report_progress() const
                                    "To recover: LSN " LSN_PF
                                    "/" LSN_PF "; %zu pages",
                                    recv_sys.lsn, recv_sys.scanned_lsn, n);
+    return;
+  }
+
+  const time_t elapsed{progress_time - apply_start_time};
+  const size_t applied{apply_start_pages > n ? apply_start_pages - n : 0};
+
+  if (!apply_log_recs || elapsed <= 0 || !applied)
+  {
+    sql_print_information("InnoDB: To recover: %zu pages", n);
+    service_manager_extend_timeout(INNODB_EXTEND_TIMEOUT_INTERVAL,
+                                   "To recover: %zu pages", n);
+    return;
   }
+
+  /* The estimate only covers the pages of the current batch; further
+  batches may follow if the log did not fit in the buffer pool. */
+  const size_t rate{std::max<size_t>(applied / size_t(elapsed), 1)};
+  sql_print_information("InnoDB: To recover: %zu pages;"
+                        " applying %zu pages/s,"
+                        " %zu s remaining in this batch",
+                        n, rate, n / rate);
+  service_manager_extend_timeout(INNODB_EXTEND_TIMEOUT_INTERVAL,
+                                 "To recover: %zu pages;"
+                                 " %zu s remaining in this batch",
+                                 n, n / rate);
 }
 
 /** Apply a recovery batch.
@@ -3866,6 +3884,8 @@ void recv_sys_t::apply(bool last_batch)
     progress_time= time(nullptr);
     report_progress();
 
+    apply_start_time= progress_time;
+    apply_start_pages= pages.size();
     apply_log_recs= true;
 
     fil_system.extend_to_recv_size();
@@ -1002,6 +1002,7 @@ ATTRIBUTE_COLD size_t log_t::append_prepare_wait(size_t b, bool ex, lsn_t lsn)
   noexcept
 {
   waits++;
+  const ulonglong start= my_interval_timer();
   ut_ad(buf_free.load(std::memory_order_relaxed) ==
         (spin ? (b | buf_free_LOCK) : b));
   if (spin)
@@ -1022,10 +1023,15 @@ ATTRIBUTE_COLD size_t log_t::append_prepare_wait(size_t b, bool ex, lsn_t lsn)
     latch.rd_lock(SRW_LOCK_CALL);
 
   if (spin)
-    return lock_lsn();
+    b= lock_lsn();
+  else
+  {
+    lsn_lock.wr_lock();
+    b= buf_free.load(std::memory_order_relaxed);
+  }
 
-  lsn_lock.wr_lock();
-  return buf_free.load(std::memory_order_relaxed);
+  wait_time+= (my_interval_timer() - start) / 1000;
+  return b;
 }
 
 /** Reserve space in the log buffer for appending data.
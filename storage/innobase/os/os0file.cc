@@ -3655,6 +3655,16 @@ dberr_t os_aio(const IORequest &type, void *buf, os_offset_t offset, size_t n)
 	goto func_exit;
 }
 
+void os_aio_batch_begin()
+{
+  srv_thread_pool->submit_io_batch_begin();
+}
+
+void os_aio_batch_end()
+{
+  srv_thread_pool->submit_io_batch_end();
+}
+
 /** Prints info of the aio arrays.
 @param[in,out]	file		file where to print */
 void
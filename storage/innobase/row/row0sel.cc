@@ -3872,11 +3872,20 @@ row_sel_prefetch_cache_init(
 	ulint	sz;
 	byte*	ptr;
 
-	/* Reserve space for the magic number. */
-	sz = UT_ARR_SIZE(prebuilt->fetch_cache) * (prebuilt->mysql_row_len + 8);
+	ut_ad(prebuilt->fetch_batch_size <= MYSQL_FETCH_CACHE_MAX_SIZE);
+	prebuilt->fetch_cache_size = std::max<ulint>(
+		prebuilt->fetch_batch_size, MYSQL_FETCH_CACHE_SIZE);
+
+	/* Reserve space for the pointer array, followed by the rows
+	and their magic numbers. */
+	sz = prebuilt->fetch_cache_size
+		* (sizeof *prebuilt->fetch_cache
+		   + prebuilt->mysql_row_len + 8);
 	ptr = static_cast<byte*>(ut_malloc_nokey(sz));
+	prebuilt->fetch_cache = reinterpret_cast<byte**>(ptr);
+	ptr += prebuilt->fetch_cache_size * sizeof *prebuilt->fetch_cache;
 
-	for (i = 0; i < UT_ARR_SIZE(prebuilt->fetch_cache); i++) {
+	for (i = 0; i < prebuilt->fetch_cache_size; i++) {
 
 		/* A user has reported memory corruption in these
 		buffers in Linux. Put magic numbers there to help
@@ -3893,6 +3902,56 @@ row_sel_prefetch_cache_init(
 	}
 }
 
+/** Free the prefetch cache.
+@param prebuilt   prebuilt struct */
+void row_sel_prefetch_cache_free(row_prebuilt_t *prebuilt)
+{
+  if (!prebuilt->fetch_cache)
+    return;
+
+  byte *ptr= prebuilt->fetch_cache[0] - 4;
+
+  for (ulint i= 0; i < prebuilt->fetch_cache_size; i++)
+  {
+    ut_a(mach_read_from_4(ptr) == ROW_PREBUILT_FETCH_MAGIC_N);
+    ptr+= 4;
+    ut_a(ptr == prebuilt->fetch_cache[i]);
+    ptr+= prebuilt->mysql_row_len;
+    ut_a(mach_read_from_4(ptr) == ROW_PREBUILT_FETCH_MAGIC_N);
+    ptr+= 4;
+  }
+
+  ut_free(prebuilt->fetch_cache);
+  prebuilt->fetch_cache= nullptr;
+  prebuilt->fetch_cache_size= 0;
+}
+
+/** Start a new fetch_cache batch after the positioning of a cursor.
+@param prebuilt   prebuilt struct */
+static void row_sel_fetch_batch_reset(row_prebuilt_t *prebuilt)
+{
+  prebuilt->n_rows_fetched= 0;
+  prebuilt->n_fetch_cached= 0;
+  prebuilt->fetch_cache_first= 0;
+  prebuilt->fetch_batch_size= MYSQL_FETCH_CACHE_SIZE;
+}
+
+/** Grow the fetch_cache batch size after a full batch was filled.
+Long scans from the same cursor will convert more rows per
+row_search_mvcc() call, reducing the number of mini-transactions and
+cursor restorations, while short scans (such as LIMIT queries) keep
+using small batches.
+@param prebuilt   prebuilt struct */
+static void row_sel_fetch_batch_grow(row_prebuilt_t *prebuilt)
+{
+  ulint max_size= MYSQL_FETCH_CACHE_MAX_BYTES / (prebuilt->mysql_row_len + 8);
+  max_size= std::max<ulint>(std::min<ulint>(max_size,
+                                            MYSQL_FETCH_CACHE_MAX_SIZE),
+                            MYSQL_FETCH_CACHE_SIZE);
+  prebuilt->fetch_batch_size= std::min(prebuilt->fetch_batch_size * 2,
+                                       max_size);
+}
+
 /********************************************************************//**
 Get the last fetch cache buffer from the queue.
 @return pointer to buffer. */
@@ -3903,12 +3962,14 @@ row_sel_fetch_last_buf(
 	row_prebuilt_t*	prebuilt)	/*!< in/out: prebuilt struct */
 {
 	ut_ad(!prebuilt->templ_contains_blob);
-	ut_ad(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+	ut_ad(prebuilt->n_fetch_cached < prebuilt->fetch_batch_size);
 
-	if (prebuilt->fetch_cache[0] == NULL) {
-		/* Allocate memory for the fetch cache */
+	if (prebuilt->fetch_cache_size < prebuilt->fetch_batch_size) {
+		/* Allocate memory for the fetch cache, or grow it
+		before a new batch is started. */
 		ut_ad(prebuilt->n_fetch_cached == 0);
 
+		row_sel_prefetch_cache_free(prebuilt);
 		row_sel_prefetch_cache_init(prebuilt);
 	}
 
@@ -4419,9 +4480,7 @@ row_search_mvcc(
 	if (UNIV_UNLIKELY(direction == 0)) {
 		trx->op_info = "starting index read";
 
-		prebuilt->n_rows_fetched = 0;
-		prebuilt->n_fetch_cached = 0;
-		prebuilt->fetch_cache_first = 0;
+		row_sel_fetch_batch_reset(prebuilt);
 
 		if (prebuilt->sel_graph == NULL) {
 			/* Build a dummy select query graph */
@@ -4443,9 +4502,7 @@ row_search_mvcc(
 				cursor! */
 			}
 
-			prebuilt->n_rows_fetched = 0;
-			prebuilt->n_fetch_cached = 0;
-			prebuilt->fetch_cache_first = 0;
+			row_sel_fetch_batch_reset(prebuilt);
 
 		} else if (UNIV_LIKELY(prebuilt->n_fetch_cached > 0)) {
 			row_sel_dequeue_cached_row_for_mysql(buf, prebuilt);
@@ -4456,7 +4513,8 @@ row_search_mvcc(
 		}
 
 		if (prebuilt->fetch_cache_first > 0
-		    && prebuilt->fetch_cache_first < MYSQL_FETCH_CACHE_SIZE) {
+		    && prebuilt->fetch_cache_first
+		    < prebuilt->fetch_batch_size) {
 early_not_found:
 			/* The previous returned row was popped from the fetch
 			cache, but the cache was not full at the time of the
@@ -5641,7 +5699,7 @@ row_search_mvcc(
 		not cache rows because there the cursor is a scrollable
 		cursor. */
 
-		ut_a(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+		ut_a(prebuilt->n_fetch_cached < prebuilt->fetch_batch_size);
 
 		/* We only convert from InnoDB row format to MySQL row
 		format when ICP is disabled. */
@@ -5693,9 +5751,11 @@ row_search_mvcc(
 			row_sel_enqueue_cache_row_for_mysql(buf, prebuilt);
 		}
 
-		if (prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE) {
+		if (prebuilt->n_fetch_cached < prebuilt->fetch_batch_size) {
 			goto next_rec;
 		}
+
+		row_sel_fetch_batch_grow(prebuilt);
 	} else {
 		if (!prebuilt->pk_filter && !prebuilt->idx_cond) {
 			/* The record was not yet converted to MySQL format. */
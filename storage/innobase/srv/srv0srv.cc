@@ -209,6 +209,8 @@ uint	srv_n_write_io_threads;
 
 /** innodb_random_read_ahead */
 my_bool	srv_random_read_ahead;
+/** innodb_leaf_read_ahead */
+my_bool	srv_leaf_read_ahead;
 /** innodb_read_ahead_threshold; the number of pages that must be present
 in the buffer cache and accessed sequentially for InnoDB to trigger a
 readahead request. */
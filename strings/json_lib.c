@@ -369,8 +369,21 @@ int json_read_string_const_chr(json_string_t *js)
 static int skip_str_constant(json_engine_t *j)
 {
   int t, c_len;
+  /*
+    In an ASCII-compatible character set a byte below 128 is always
+    a character of its own, so runs of ordinary ASCII characters can be
+    skipped without decoding them one by one with j->s.wc().
+  */
+  const my_bool ascii_based= my_charset_is_ascii_based(j->s.cs);
   for (;;)
   {
+    if (ascii_based)
+    {
+      const uchar *p= j->s.c_str;
+      while (p < j->s.str_end && *p < 128 && json_instr_chr_map[*p] <= S_ETC)
+        p++;
+      j->s.c_str= p;
+    }
     if ((c_len= json_next_char(&j->s)) > 0)
     {
       j->s.c_str+= c_len;
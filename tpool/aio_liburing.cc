@@ -31,6 +31,16 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02111 - 1301 USA*/
 namespace
 {
 
+/** Number of requests that the current thread prepared but did not submit
+since aio_uring::submit_batch_begin(), or -1 outside a batch */
+static thread_local int deferred_ios= -1;
+
+/** Maximum number of requests that a thread may defer. This must be
+smaller than the number of I/O slots, so that a thread that waits for a
+free slot while deferring requests will always be woken up by the
+completion of some request that was already submitted. */
+static constexpr int max_deferred_ios= 16;
+
 class aio_uring final : public tpool::aio
 {
 public:
@@ -107,6 +117,13 @@ class aio_uring final : public tpool::aio
     std::lock_guard<std::mutex> _(mutex_);
 
     io_uring_sqe *sqe= io_uring_get_sqe(&uring_);
+    if (!sqe)
+    {
+      // The submission queue is full of requests deferred by
+      // submit_batch_begin().
+      if (io_uring_submit(&uring_) <= 0 || !(sqe= io_uring_get_sqe(&uring_)))
+        return -1;
+    }
     if (cb->m_opcode == tpool::aio_opcode::AIO_PREAD)
       io_uring_prep_readv(sqe, cb->m_fh, static_cast<struct iovec *>(cb), 1,
                           cb->m_offset);
@@ -115,7 +132,41 @@ class aio_uring final : public tpool::aio
                            cb->m_offset);
     io_uring_sqe_set_data(sqe, cb);
 
-    return io_uring_submit(&uring_) == 1 ? 0 : -1;
+    if (deferred_ios >= 0)
+    {
+      if (++deferred_ios < max_deferred_ios)
+        return 0;
+      deferred_ios= 0;
+    }
+
+    // This may also submit requests that were deferred by other threads.
+    return io_uring_submit(&uring_) > 0 ? 0 : -1;
+  }
+
+  void submit_batch_begin() final
+  {
+    assert(deferred_ios < 0);
+    deferred_ios= 0;
+  }
+
+  void submit_batch_end() final
+  {
+    assert(deferred_ios >= 0);
+    if (deferred_ios > 0)
+    {
+      std::lock_guard<std::mutex> _(mutex_);
+      // The requests may already have been submitted by other threads.
+      int ret= io_uring_submit(&uring_);
+      if (ret < 0)
+      {
+        my_printf_error(ER_UNKNOWN_ERROR,
+                        "io_uring_submit() returned %d for %d deferred"
+                        " requests: this may cause a hang\n",
+                        ME_ERROR_LOG | ME_FATAL, ret, deferred_ios);
+        abort();
+      }
+    }
+    deferred_ios= -1;
   }
 
   int bind(native_file_handle &fd) final
@@ -182,6 +182,14 @@ class aio
     On completion, cb->m_callback is executed.
   */
   virtual int submit_io(aiocb *cb)= 0;
+  /**
+    Start a batch of submit_io() calls from the current thread.
+    The implementation may defer the submission of the requests until
+    submit_batch_end(), to submit several requests in one system call.
+  */
+  virtual void submit_batch_begin() {}
+  /** End a batch of submit_io() calls, submitting any deferred requests */
+  virtual void submit_batch_end() {}
   /** "Bind" file to AIO handler (used on Windows only) */
   virtual int bind(native_file_handle &fd)= 0;
   /** "Unind" file to AIO handler (used on Windows only) */
@@ -287,6 +295,8 @@ class thread_pool
   int bind(native_file_handle &fd) { return m_aio->bind(fd); }
   void unbind(const native_file_handle &fd) { if (m_aio) m_aio->unbind(fd); }
   int submit_io(aiocb *cb) { return m_aio->submit_io(cb); }
+  void submit_io_batch_begin() { m_aio->submit_batch_begin(); }
+  void submit_io_batch_end() { m_aio->submit_batch_end(); }
   virtual void wait_begin() {};
   virtual void wait_end() {};
   virtual ~thread_pool() {}